@@ -23,7 +23,8 @@ DEFINES += QT_DEPRECATED_WARNINGS
 SOURCES += \
         src/main.cpp \
     src/Sensor.cpp \
-    src/Simulator.cpp
+    src/Simulator.cpp \
+    src/Scenario.cpp
 
 # Default rules for deployment.
 qnx: target.path = /tmp/$${TARGET}/bin
@@ -33,4 +34,7 @@ else: unix:!android: target.path = /opt/$${TARGET}/bin
 HEADERS += \
     src/Sensor.hpp \
     src/Simulator.hpp \
-    src/Frequency.hpp
+    src/Frequency.hpp \
+    src/Aggregate.hpp \
+    src/Scenario.hpp \
+    src/Protocol.hpp
@@ -0,0 +1,97 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 azarias.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * File:   Aggregate.hpp
+ * Author: azarias
+ *
+ * Created on 19/10/2026
+ */
+#pragma once
+
+#include <QtGlobal>
+#include <algorithm>
+#include <limits>
+
+/**
+ * @brief The Aggregate struct
+ * running statistics of the values sensed by
+ * one sensor during a window (mode 4)
+ * uses a constant amount of memory, whatever the sensor frequency
+ */
+struct Aggregate
+{
+    /**
+     * @brief firstTimestamp timestamp of the first value of the window
+     */
+    quint32 firstTimestamp = 0;
+
+    /**
+     * @brief count number of values sensed during the window
+     */
+    quint16 count = 0;
+
+    qint16 min = std::numeric_limits<qint16>::max();
+
+    qint16 max = std::numeric_limits<qint16>::min();
+
+    /**
+     * @brief sum of all the values, used to compute the mean
+     */
+    quint32 sum = 0;
+
+    /**
+     * @brief add adds a sensed value to the window
+     * @param value value generated
+     * @param timestamp time at which it was generated
+     */
+    void add(qint16 value, quint32 timestamp)
+    {
+        if(count == std::numeric_limits<quint16>::max()) return;
+        if(count == 0){
+            firstTimestamp = timestamp;
+        }
+        ++count;
+        min = std::min(min, value);
+        max = std::max(max, value);
+        sum += quint32(value);
+    }
+
+    /**
+     * @brief mean average of the values of the window
+     * @return 0 if the window is empty
+     */
+    qint16 mean() const
+    {
+        return count ? qint16(sum / count) : 0;
+    }
+
+    /**
+     * @brief reset empties the window
+     */
+    void reset()
+    {
+        *this = Aggregate();
+    }
+};
@@ -0,0 +1,73 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 azarias.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * File:   Protocol.hpp
+ * Author: azarias
+ *
+ * Created on 19/10/2026
+ */
+#pragma once
+
+#include <QtGlobal>
+#include <limits>
+
+/*
+ * Commands and constants shared by the simulator and the validator
+ */
+
+constexpr int SENSOR_COUNT = 3;
+constexpr int MAX_VALUES = std::numeric_limits<quint16>::max();
+constexpr quint16 SIZE_MASK = 0xFFFF;
+constexpr qint8 SUCCESS_BIT = 0x0;
+constexpr qint8 ERROR_BIT = 0x1;
+
+constexpr qint16 SENSORID_MASK  = 0b0000000000000011;
+constexpr qint16 FREQUENCY_MASK = 0b0000000000001111;
+constexpr qint16 VALUE_MASK     = 0b0000001111111111;
+
+enum class WORKING_MODE : qint8 {
+    NO_MODE = 0x0,
+    MODE_1 = 0x1,
+    MODE_2 = 0x2,
+    MODE_3 = 0x3,
+    MODE_4 = 0x4,
+};
+
+enum WeatherCommand : quint8 {
+    STOP_MODE = 0x0,
+    START_MODE_1 = 0x1,
+    START_MODE_2 = 0x2,
+    START_MODE_3 = 0x3,
+    GET_DATA = 0x4,
+    CONFIGURE_FE_1 = 0x5,
+    CONFIGURE_FE_2 = 0x6,
+    CONFIGURE_FE_3 = 0x7,
+    CONFIGURE_MODE_2 = 0x8,
+    SEND_MODE1_DATA = 0x9,
+    SEND_MODE2_DATA = 0xA,
+    GET_FREQUENCIES = 0xB,
+    START_MODE_4 = 0xC,
+    SEND_MODE4_DATA = 0xD
+};
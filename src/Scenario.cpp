@@ -0,0 +1,189 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 azarias.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * File:   Scenario.cpp
+ * Author: azarias
+ *
+ * Created on 19/10/2026
+ */
+#include "Scenario.hpp"
+#include "Protocol.hpp"
+#include <QDebug>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QRandomGenerator>
+#include <QStringList>
+#include <QtMath>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+constexpr int TABLE_SIZE = 1024;
+constexpr int NOISE_TABLE_SIZE = 4096;
+
+static const QStringList SHAPES = {"sine", "square", "triangle", "sawtooth", "gust"};
+
+Scenario::Scenario(const QJsonObject &definition) :
+    m_empty(false),
+    m_base(float(definition.value("base").toDouble(512.0)))
+{
+    for(const QJsonValue &value : definition.value("components").toArray()){
+        QJsonObject component = value.toObject();
+        QString type = component.value("type").toString();
+        float amplitude = float(component.value("amplitude").toDouble());
+        quint32 period = std::max<quint32>(1, milliseconds(component, "period", 1000));
+
+        if(type == "periodic"){
+            QString shape = component.value("shape").toString("sine");
+            if(!SHAPES.contains(shape)){
+                qWarning() << "Unknown scenario shape" << shape;
+                continue;
+            }
+            m_tables.append(periodicTable(shape, amplitude, period));
+        } else if(type == "noise"){
+            m_tables.append(noiseTable(amplitude, period));
+        } else if(type == "trend"){
+            m_slope += float(component.value("slope").toDouble()) / 1000.f;
+        } else if(type == "step"){
+            m_steps.append({milliseconds(component, "at", 0), amplitude});
+        } else {
+            qWarning() << "Unknown scenario component" << type;
+        }
+    }
+}
+
+quint32 Scenario::milliseconds(const QJsonObject &component, const QString &key, quint32 defaultValue)
+{
+    QJsonValue value = component.value(key);
+    if(value.isUndefined()){
+        return defaultValue;
+    }
+    double duration = value.toDouble(-1.0);
+    if(duration < 0.0 || duration > double(std::numeric_limits<quint32>::max())){
+        qWarning() << "Invalid scenario" << key << value << ", using" << defaultValue << "ms";
+        return defaultValue;
+    }
+    return quint32(std::lround(duration));
+}
+
+bool Scenario::isEmpty() const
+{
+    return m_empty;
+}
+
+qint16 Scenario::valueAt(quint32 timestamp) const
+{
+    float value = m_base + m_slope * timestamp;
+    for(const Table &table : m_tables){
+        value += table.valueAt(timestamp);
+    }
+    for(const Step &step : m_steps){
+        if(timestamp >= step.at){
+            value += step.amplitude;
+        }
+    }
+    return qint16(std::clamp(value, 0.f, 1023.f));
+}
+
+float Scenario::Table::valueAt(quint32 timestamp) const
+{
+    float position = float(timestamp % period) * scale;
+    int index = std::min(int(position), int(samples.size()) - 2);
+    float fraction = position - index;
+    return samples[index] + (samples[index + 1] - samples[index]) * fraction;
+}
+
+Scenario::Table Scenario::periodicTable(const QString &shape, float amplitude, quint32 period)
+{
+    Table table;
+    table.period = period;
+    table.scale = float(TABLE_SIZE) / period;
+    table.samples.resize(TABLE_SIZE + 1);
+    for(int i = 0; i < TABLE_SIZE; ++i){
+        float x = float(i) / TABLE_SIZE;
+        float sample;
+        if(shape == "square"){
+            sample = x < 0.5f ? 1.f : -1.f;
+        } else if(shape == "triangle"){
+            sample = 1.f - 4.f * std::abs(x - 0.5f);
+        } else if(shape == "sawtooth"){
+            sample = 2.f * x - 1.f;
+        } else if(shape == "gust"){
+            sample = std::exp(-x * 20.f);
+        } else {
+            sample = std::sin(2.f * float(M_PI) * x);
+        }
+        table.samples[i] = sample * amplitude;
+    }
+    table.samples[TABLE_SIZE] = table.samples[0];
+    return table;
+}
+
+Scenario::Table Scenario::noiseTable(float amplitude, quint32 period)
+{
+    Table table;
+    period = std::min<quint32>(period, std::numeric_limits<quint32>::max() / NOISE_TABLE_SIZE);
+    table.period = period * NOISE_TABLE_SIZE;
+    table.scale = 1.f / period;
+    table.samples.resize(NOISE_TABLE_SIZE + 1);
+    for(int i = 0; i < NOISE_TABLE_SIZE; ++i){
+        table.samples[i] = float(QRandomGenerator::global()->generateDouble() * 2.0 - 1.0) * amplitude;
+    }
+    table.samples[NOISE_TABLE_SIZE] = table.samples[0];
+    return table;
+}
+
+QMap<qint8, Scenario> Scenario::loadFile(const QString &path, bool &ok)
+{
+    QMap<qint8, Scenario> scenarios;
+    QFile file(path);
+    if(!file.open(QIODevice::ReadOnly)){
+        qWarning() << "Could not open scenario file" << path << ":" << file.errorString();
+        ok = false;
+        return scenarios;
+    }
+
+    QJsonParseError error;
+    QJsonDocument document = QJsonDocument::fromJson(file.readAll(), &error);
+    if(!document.isObject()){
+        qWarning() << "Invalid scenario file" << path << ":" << error.errorString();
+        ok = false;
+        return scenarios;
+    }
+
+    QJsonObject root = document.object();
+    for(auto it = root.begin(); it != root.end(); ++it){
+        bool isId = false;
+        int sensorId = it.key().toInt(&isId);
+        if(!isId || sensorId < 1 || sensorId > SENSOR_COUNT || !it.value().isObject()){
+            qWarning() << "Ignoring scenario" << it.key();
+            continue;
+        }
+        scenarios.insert(qint8(sensorId), Scenario(it.value().toObject()));
+    }
+    ok = true;
+    return scenarios;
+}
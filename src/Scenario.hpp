@@ -0,0 +1,177 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 azarias.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * File:   Scenario.hpp
+ * Author: azarias
+ *
+ * Created on 19/10/2026
+ */
+#pragma once
+
+#include <QJsonObject>
+#include <QMap>
+#include <QVector>
+
+/**
+ * @brief The Scenario class
+ * Describes the shape of the values generated by a sensor,
+ * as a composition of periodic, trend, step and noise components.
+ * Periodic and noise components are precomputed into lookup tables
+ * when the scenario is created, so generating a value only costs
+ * a few table lookups and interpolations
+ *
+ * Definition example :
+ * {
+ *     "base": 512,
+ *     "components": [
+ *         { "type": "periodic", "shape": "sine", "amplitude": 200, "period": 86400000 },
+ *         { "type": "periodic", "shape": "gust", "amplitude": 150, "period": 45000 },
+ *         { "type": "trend", "slope": 0.5 },
+ *         { "type": "step", "amplitude": -100, "at": 60000 },
+ *         { "type": "noise", "amplitude": 10, "period": 500 }
+ *     ]
+ * }
+ * periods and 'at' are in milliseconds, slope is per second
+ * times count from the start of the current mode : the sensors restart their
+ * timestamps on every mode change, so phases, trends and steps restart too
+ * the keys of a scenario file are the ids of the sensors, from 1 to 3
+ * shapes : sine, square, triangle, sawtooth, gust
+ */
+class Scenario
+{
+public:
+    /**
+     * @brief Scenario empty scenario, generates nothing
+     */
+    Scenario() = default;
+
+    /**
+     * @brief Scenario creates the scenario and precomputes its tables
+     * @param definition json definition of the scenario
+     */
+    explicit Scenario(const QJsonObject &definition);
+
+    /**
+     * @brief isEmpty if the scenario has no definition
+     * @return
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief valueAt value of the scenario at the given time
+     * @param timestamp time in milliseconds
+     * @return the value, clamped on ten bits
+     */
+    qint16 valueAt(quint32 timestamp) const;
+
+    /**
+     * @brief loadFile loads the scenarios of the sensors from a json file
+     * the keys of the root object are the ids of the sensors ("1", "2", "3")
+     * @param path path of the file
+     * @param ok set to false if the file could not be read
+     * @return the scenarios, by sensor id
+     */
+    static QMap<qint8, Scenario> loadFile(const QString &path, bool &ok);
+
+private:
+    /**
+     * @brief The Table struct
+     * one period of a component, sampled
+     */
+    struct Table
+    {
+        /**
+         * @brief samples values of the period, with the first one repeated at the end
+         * so that interpolation never has to wrap
+         */
+        QVector<float> samples;
+
+        /**
+         * @brief period duration of the period, in milliseconds
+         */
+        quint32 period = 1;
+
+        /**
+         * @brief scale number of samples per millisecond
+         */
+        float scale = 1.f;
+
+        /**
+         * @brief valueAt linear interpolation between the two closest samples
+         * @param timestamp time in milliseconds
+         * @return
+         */
+        float valueAt(quint32 timestamp) const;
+    };
+
+    /**
+     * @brief The Step struct
+     * offset added once the given time is reached
+     */
+    struct Step
+    {
+        quint32 at;
+        float amplitude;
+    };
+
+    bool m_empty = true;
+
+    float m_base = 512.f;
+
+    /**
+     * @brief m_slope trend, per millisecond
+     */
+    float m_slope = 0.f;
+
+    QVector<Table> m_tables;
+
+    QVector<Step> m_steps;
+
+    /**
+     * @brief periodicTable samples one period of the given shape
+     * @param shape name of the shape
+     * @param amplitude amplitude of the shape
+     * @param period period in milliseconds
+     * @return
+     */
+    static Table periodicTable(const QString &shape, float amplitude, quint32 period);
+
+    /**
+     * @brief noiseTable random samples, spaced by the given period
+     * @param amplitude maximum absolute value of the noise
+     * @param period time between two random samples, in milliseconds
+     * @return
+     */
+    static Table noiseTable(float amplitude, quint32 period);
+
+    /**
+     * @brief milliseconds reads a duration of a component
+     * @param component json definition of the component
+     * @param key name of the duration
+     * @param defaultValue used when the duration is missing or invalid
+     * @return the duration, in milliseconds
+     */
+    static quint32 milliseconds(const QJsonObject &component, const QString &key, quint32 defaultValue);
+};
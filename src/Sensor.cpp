@@ -58,10 +58,19 @@ void Sensor::restart()
     m_timer.start();
 }
 
+void Sensor::setScenario(const Scenario &scenario)
+{
+    m_scenario = scenario;
+}
+
 inline void Sensor::fakeValue()
 {
-    m_value = m_value + QRandomGenerator::global()->bounded(-30, 30);
-    m_value = std::clamp<qint16>(m_value, 0, 1023);
+    if(m_scenario.isEmpty()){
+        m_value = m_value + QRandomGenerator::global()->bounded(-30, 30);
+        m_value = std::clamp<qint16>(m_value, 0, 1023);
+    } else {
+        m_value = m_scenario.valueAt(m_timestamp);
+    }
     emit sensedValue(m_value, m_timestamp);
     m_timestamp += m_timer.interval();
 }
@@ -32,6 +32,7 @@
 
 #include <QObject>
 #include <QTimer>
+#include "Scenario.hpp"
 
 #define TEN_BITS 0b0000001111111111
 
@@ -70,6 +71,13 @@ public:
      */
     void restart();
 
+    /**
+     * @brief setScenario sets the scenario used to generate the values
+     * an empty scenario falls back to a random walk
+     * @param scenario
+     */
+    void setScenario(const Scenario &scenario);
+
 signals:
     /**
      * @brief sensedValue signal emitted when this sensor generates a value
@@ -85,6 +93,8 @@ private:
 
     quint32 m_timestamp = 0;
 
+    Scenario m_scenario;
+
     /**
      * @brief create an emit a fake value (encoded on ten bits)
      */
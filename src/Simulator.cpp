@@ -40,6 +40,8 @@ Simulator::Simulator(QSerialPort &port, QObject *parent) : QObject(parent),
 {
     m_mode2Timer.setSingleShot(false);
     m_mode2Timer.setInterval(5000);
+    m_mode4Timer.setSingleShot(false);
+    m_mode4Timer.setInterval(5000);
 
     connect(&port, &QSerialPort::readyRead, [&](){
         QByteArray data = port.readAll();
@@ -47,12 +49,31 @@ Simulator::Simulator(QSerialPort &port, QObject *parent) : QObject(parent),
     });
 
     connect(&m_mode2Timer, &QTimer::timeout, [&](){ this->sendAllValues(false); });
+    connect(&m_mode4Timer, &QTimer::timeout, [&](){ this->sendAggregates(); });
 
     connect(&m_sensor1, &Sensor::sensedValue, [&](qint16 val, quint32 tmstp){ this->receiveValue(val, tmstp, 1); });
     connect(&m_sensor2, &Sensor::sensedValue, [&](qint16 val, quint32 tmstp){ this->receiveValue(val, tmstp, 2); });
     connect(&m_sensor3, &Sensor::sensedValue, [&](qint16 val, quint32 tmstp){ this->receiveValue(val, tmstp, 3); });
 }
 
+void Simulator::setScenario(qint8 sensorId, const Scenario &scenario)
+{
+    switch (sensorId) {
+    case 1:
+        m_sensor1.setScenario(scenario);
+        break;
+    case 2:
+        m_sensor2.setScenario(scenario);
+        break;
+    case 3:
+        m_sensor3.setScenario(scenario);
+        break;
+    default:
+        qWarning() << "No sensor with id" << sensorId;
+        break;
+    }
+}
+
 inline QByteArray Simulator::toData(qint8 sendingMode, quint32 timestamp,  qint16 value, qint8 sensorId) const
 {
     std::bitset<48> data;
@@ -113,6 +134,9 @@ void Simulator::receiveValue(qint16 value, quint32 tmstp, qint8 sensorId)
         }
         m_values.append(toData(GET_DATA, tmstp, value, sensorId));
         return;
+    case WORKING_MODE::MODE_4:
+        m_aggregates[std::size_t(sensorId - 1)].add(value, tmstp);
+        return;
     }
 }
 
@@ -137,6 +161,43 @@ void Simulator::sendAllValues(bool forced)
     m_values.clear();
 }
 
+QByteArray Simulator::toAggregateData(const Aggregate &aggregate, qint8 sensorId)
+{
+    QByteArray res;
+    res.append(SEND_MODE4_DATA);
+    res.append(char(sensorId & SENSORID_MASK));
+    for(int shift = 24; shift >= 0; shift -= 8){
+        res.append(char((aggregate.firstTimestamp >> shift) & 0xFF));
+    }
+    for(quint16 field : {aggregate.count,
+                         quint16(aggregate.min & VALUE_MASK),
+                         quint16(aggregate.max & VALUE_MASK),
+                         quint16(aggregate.mean() & VALUE_MASK)}){
+        res.append(char((field >> 8) & 0x00FF));
+        res.append(char(field & 0x00FF));
+    }
+    return res;
+}
+
+void Simulator::sendAggregates()
+{
+    QByteArray records;
+    for(std::size_t i = 0; i < m_aggregates.size(); ++i){
+        if(m_aggregates[i].count == 0) continue;
+        records.append(toAggregateData(m_aggregates[i], qint8(i + 1)));
+    }
+    resetAggregates();
+    if(!records.isEmpty()){
+        sendBytes(records);
+    }
+}
+
+void Simulator::resetAggregates()
+{
+    for(Aggregate &aggregate : m_aggregates){
+        aggregate.reset();
+    }
+}
 
 QByteArray Simulator::success(qint8 command)
 {
@@ -154,21 +215,38 @@ QByteArray Simulator::failure(qint8 command)
     return arr;
 }
 
+qint8 Simulator::startCommand(WORKING_MODE mode)
+{
+    switch (mode) {
+    case WORKING_MODE::NO_MODE: return STOP_MODE;
+    case WORKING_MODE::MODE_1: return START_MODE_1;
+    case WORKING_MODE::MODE_2: return START_MODE_2;
+    case WORKING_MODE::MODE_3: return START_MODE_3;
+    case WORKING_MODE::MODE_4: return START_MODE_4;
+    }
+    return STOP_MODE;
+}
+
 QByteArray Simulator::setCurrentMode(WORKING_MODE nwMode)
 {
-    qint8 modeInt = static_cast<qint8>(nwMode);
+    qint8 command = startCommand(nwMode);
     if(nwMode == m_mode){
-        return success(modeInt);
+        return success(command);
+    }
+    if(m_mode == WORKING_MODE::MODE_4){
+        sendAggregates();
     }
     m_mode = nwMode;
     m_mode2Timer.stop();
+    m_mode4Timer.stop();
+    resetAggregates();
     m_started = m_mode != WORKING_MODE::NO_MODE;
     if(m_started){
         m_sensor1.restart();
         m_sensor2.restart();
         m_sensor3.restart();
     }
-    return success(modeInt);
+    return success(command);
 }
 
 QByteArray Simulator::getFrequencies()
@@ -208,6 +286,16 @@ void Simulator::readCommand(const QByteArray &array)
         case START_MODE_3:
             sendBytes(setCurrentMode(WORKING_MODE::MODE_3));
             break;
+        case START_MODE_4:
+            if(m_mode == WORKING_MODE::MODE_4){
+                sendAggregates();
+            }
+            if(data != 0){
+                m_mode4Timer.setInterval(int(quint8(data)) * 1000);
+            }
+            sendBytes(setCurrentMode(WORKING_MODE::MODE_4));
+            m_mode4Timer.start();
+            break;
         case GET_DATA:
             sendAllValues(true);
             return;
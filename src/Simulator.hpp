@@ -33,38 +33,10 @@
 #include <QObject>
 #include <QVector>
 #include <QtSerialPort>
+#include <array>
 #include "Sensor.hpp"
-
-constexpr int MAX_VALUES = std::numeric_limits<quint16>::max();
-constexpr quint16 SIZE_MASK = 0xFFFF;
-constexpr qint8 SUCCESS_BIT = 0x0;
-constexpr qint8 ERROR_BIT = 0x1;
-
-constexpr qint16 SENSORID_MASK  = 0b0000000000000011;
-constexpr qint16 FREQUENCY_MASK = 0b0000000000001111;
-constexpr qint16 VALUE_MASK     = 0b0000001111111111;
-
-enum class WORKING_MODE : qint8 {
-    NO_MODE = 0x0,
-    MODE_1 = 0x1,
-    MODE_2 = 0x2,
-    MODE_3 = 0x3,
-};
-
-enum WeatherCommand : quint8 {
-    STOP_MODE = 0x0,
-    START_MODE_1 = 0x1,
-    START_MODE_2 = 0x2,
-    START_MODE_3 = 0x3,
-    GET_DATA = 0x4,
-    CONFIGURE_FE_1 = 0x5,
-    CONFIGURE_FE_2 = 0x6,
-    CONFIGURE_FE_3 = 0x7,
-    CONFIGURE_MODE_2 = 0x8,
-    SEND_MODE1_DATA = 0x9,
-    SEND_MODE2_DATA = 0xA,
-    GET_FREQUENCIES = 0xB
-};
+#include "Aggregate.hpp"
+#include "Protocol.hpp"
 
 /**
  * @brief The Simulator class
@@ -78,6 +50,12 @@ class Simulator : public QObject
 public:
     explicit Simulator(QSerialPort &port, QObject *parent = nullptr);
 
+    /**
+     * @brief setScenario sets the scenario of a sensor
+     * @param sensorId id of the sensor (1 to 3)
+     * @param scenario scenario used to generate the values
+     */
+    void setScenario(qint8 sensorId, const Scenario &scenario);
 
 private:
     /**
@@ -99,6 +77,18 @@ private:
      */
     QTimer m_mode2Timer;
 
+    /**
+     * @brief m_mode4Timer timer for the mode 4
+     * to send the aggregates at the end of each window
+     */
+    QTimer m_mode4Timer;
+
+    /**
+     * @brief m_aggregates statistics of the current window
+     * for each sensor (mode 4)
+     */
+    std::array<Aggregate, 3> m_aggregates;
+
     /**
      * @brief m_values sensed by the sensors
      * is filled up until send, then cleared
@@ -148,6 +138,25 @@ private:
      */
     void sendAllValues(bool forced);
 
+    /**
+     * @brief sendAggregates sends one record per sensor that sensed
+     * at least one value during the window, then starts a new window
+     */
+    void sendAggregates();
+
+    /**
+     * @brief toAggregateData turns the statistics of a window into a byte array
+     * @param aggregate statistics of the window
+     * @param sensorId sensor that generated the values
+     * @return the filled up byte array
+     */
+    static QByteArray toAggregateData(const Aggregate &aggregate, qint8 sensorId);
+
+    /**
+     * @brief resetAggregates empties the windows of all the sensors
+     */
+    void resetAggregates();
+
     /**
      * @brief getFrequencies sends to the desktop all the frequencies of the sensors
      * @return byte array containing all the frequencies
@@ -161,6 +170,14 @@ private:
      */
     QByteArray setCurrentMode(WORKING_MODE nwMode);
 
+    /**
+     * @brief startCommand the command starting the given mode,
+     * echoed back when acknowledging a mode change
+     * @param mode
+     * @return
+     */
+    static qint8 startCommand(WORKING_MODE mode);
+
     /**
      * In order to be as close as possible to the arduino, instead of sending full byte array,
      * we send values byte by byte, thus simulating the aruino perfectly
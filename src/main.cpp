@@ -28,6 +28,7 @@
  *
  * Created on 14/12/2018
  */
+#include <QCommandLineParser>
 #include <QCoreApplication>
 #include <QDebug>
 #include <QTimer>
@@ -43,12 +44,31 @@ command 1 (WeatherStation folder) : socat PTY,link=./virtual-tty,raw,echo=0 -
 command 2 (WeatherSimulator folder) : socat PTY,link=./arduino-sim,raw,echo=0 PTY,link=../../../WeatherStation/build/Debug/virtual-tty,raw,echo=0
 command 3 (WeatherSimulator folder): ./WeatherSimulator
 command 4 (WeatherStation folder): ./WeatherStation
+
+The values of the sensors can be shaped with a scenario file (see Scenario.hpp) :
+./WeatherSimulator --scenarios scenarios.json
 */
 
 
 int main(int argc, char *argv[])
 {
     QCoreApplication a(argc, argv);
+
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    QCommandLineOption scenariosOption("scenarios", "Json file describing the scenario of each sensor", "file");
+    parser.addOption(scenariosOption);
+    parser.process(a);
+
+    QMap<qint8, Scenario> scenarios;
+    if(parser.isSet(scenariosOption)){
+        bool ok = false;
+        scenarios = Scenario::loadFile(parser.value(scenariosOption), ok);
+        if(!ok){
+            return -1;
+        }
+    }
+
     QSerialPort port("./arduino-sim");
     qWarning() << "Starting simulator ...";
 
@@ -59,5 +79,9 @@ int main(int argc, char *argv[])
 
     Simulator s(port, nullptr);
 
+    for(auto it = scenarios.begin(); it != scenarios.end(); ++it){
+        s.setScenario(it.key(), it.value());
+    }
+
     return a.exec();
 }
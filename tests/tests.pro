@@ -0,0 +1,12 @@
+#-------------------------------------------------
+#
+# Unit tests, run with 'make check'
+#
+#-------------------------------------------------
+
+TEMPLATE = subdirs
+
+SUBDIRS += \
+    tst_aggregate \
+    tst_scenario \
+    tst_decoder
@@ -0,0 +1,89 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 azarias.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * File:   tst_aggregate.cpp
+ * Author: azarias
+ *
+ * Created on 19/10/2026
+ */
+#include <QtTest>
+#include "Aggregate.hpp"
+
+/**
+ * @brief The AggregateTest class
+ * checks the statistics of a mode 4 window
+ */
+class AggregateTest : public QObject
+{
+    Q_OBJECT
+private slots:
+    void emptyWindow()
+    {
+        Aggregate aggregate;
+        QCOMPARE(aggregate.count, quint16(0));
+        QCOMPARE(aggregate.mean(), qint16(0));
+    }
+
+    void statistics()
+    {
+        Aggregate aggregate;
+        aggregate.add(10, 100);
+        aggregate.add(1023, 200);
+        aggregate.add(0, 300);
+        aggregate.add(7, 400);
+        QCOMPARE(aggregate.firstTimestamp, quint32(100));
+        QCOMPARE(aggregate.count, quint16(4));
+        QCOMPARE(aggregate.min, qint16(0));
+        QCOMPARE(aggregate.max, qint16(1023));
+        QCOMPARE(aggregate.mean(), qint16((10 + 1023 + 0 + 7) / 4));
+    }
+
+    void reset()
+    {
+        Aggregate aggregate;
+        aggregate.add(500, 100);
+        aggregate.reset();
+        aggregate.add(20, 900);
+        QCOMPARE(aggregate.firstTimestamp, quint32(900));
+        QCOMPARE(aggregate.count, quint16(1));
+        QCOMPARE(aggregate.min, qint16(20));
+        QCOMPARE(aggregate.max, qint16(20));
+        QCOMPARE(aggregate.mean(), qint16(20));
+    }
+
+    void countSaturates()
+    {
+        Aggregate aggregate;
+        for(int i = 0; i < 70000; ++i){
+            aggregate.add(1023, quint32(i));
+        }
+        QCOMPARE(aggregate.count, std::numeric_limits<quint16>::max());
+        QCOMPARE(aggregate.mean(), qint16(1023));
+    }
+};
+
+QTEST_APPLESS_MAIN(AggregateTest)
+
+#include "tst_aggregate.moc"
@@ -0,0 +1,14 @@
+QT -= gui
+QT += testlib
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+INCLUDEPATH += ../../src
+
+SOURCES += \
+    tst_aggregate.cpp
+
+HEADERS += \
+    ../../src/Aggregate.hpp
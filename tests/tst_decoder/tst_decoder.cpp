@@ -0,0 +1,256 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 azarias.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * File:   tst_decoder.cpp
+ * Author: azarias
+ *
+ * Created on 19/10/2026
+ */
+#include <QtTest>
+#include "Decoder.hpp"
+
+/**
+ * @brief FREQUENCIES reply to GET_FREQUENCIES : sensor 1 at 1Hz,
+ * sensors 2 and 3 unknown, mode 2 every 5 seconds
+ */
+static const QByteArray FREQUENCIES = QByteArray::fromHex("0b01000005");
+
+/**
+ * @brief The DecoderTest class
+ * feeds recorded streams of the simulator to the decoder
+ */
+class DecoderTest : public QObject
+{
+    Q_OBJECT
+private:
+    /**
+     * @brief sample a sample as sent by the simulator (Simulator::toData)
+     */
+    static QByteArray sample(quint32 timestamp, quint8 sensorId, quint16 value)
+    {
+        quint64 raw = (quint64(timestamp) << 16) | (quint64(sensorId & 0x3F) << 10) | (value & 0x3FF);
+        QByteArray res;
+        for(int shift = 40; shift >= 0; shift -= 8){
+            res.append(char((raw >> shift) & 0xFF));
+        }
+        return res;
+    }
+
+    static QByteArray mode1(quint32 timestamp, quint8 sensorId = 1)
+    {
+        return QByteArray(1, char(SEND_MODE1_DATA)) + sample(timestamp, sensorId, 500);
+    }
+
+    static void decode(Decoder &decoder, const QByteArray &stream, qint64 now, int chunk)
+    {
+        const quint8 *data = reinterpret_cast<const quint8*>(stream.constData());
+        for(int i = 0; i < stream.size(); i += chunk){
+            decoder.decode(data + i, std::min(chunk, stream.size() - i), now);
+        }
+    }
+
+    static void decode(Decoder &decoder, const QByteArray &stream, qint64 now = 0)
+    {
+        decode(decoder, stream, now, stream.size());
+    }
+
+private slots:
+    void streams_data()
+    {
+        QTest::addColumn<QByteArray>("sent");
+        QTest::addColumn<QByteArray>("stream");
+        QTest::addColumn<int>("samples");
+        QTest::addColumn<int>("framingErrors");
+        QTest::addColumn<int>("orderErrors");
+        QTest::addColumn<int>("gapErrors");
+        QTest::addColumn<int>("rateErrors");
+
+        QTest::newRow("mode 1") << QByteArray()
+                                << QByteArray::fromHex("0100") + mode1(0) + mode1(1000) + mode1(0, 2) + mode1(2000)
+                                << 4 << 0 << 0 << 0 << 0;
+        QTest::newRow("mode 2") << QByteArray()
+                                << QByteArray::fromHex("02000a0004") + sample(0, 1, 1) + sample(0, 2, 2)
+                                   + sample(1000, 1, 3) + sample(500, 2, 4) + QByteArray::fromHex("0a0000")
+                                << 4 << 0 << 0 << 0 << 0;
+        QTest::newRow("mode 3") << QByteArray()
+                                << QByteArray::fromHex("0300040002") + sample(0, 1, 1) + sample(1000, 1, 2)
+                                   + QByteArray::fromHex("040000040001") + sample(2000, 1, 3)
+                                << 3 << 0 << 0 << 0 << 0;
+        QTest::newRow("mode 4") << QByteArray()
+                                << QByteArray::fromHex("0c00"
+                                                       "0d01000000000005" "01f001f801f4"
+                                                       "0d0200000000000a" "000003ff0200"
+                                                       "0d01000013880005" "01f401f401f4"
+                                                       "0000")
+                                << 3 << 0 << 0 << 0 << 0;
+        QTest::newRow("short mode 4 record") << QByteArray()
+                                             << QByteArray::fromHex("0c00"
+                                                                    "0d01000000000004" "01f001f801f4"
+                                                                    "0d01000013880005" "01f401f401f4"
+                                                                    "0d01000027100005" "01f401f401f4")
+                                             << 3 << 0 << 0 << 0 << 1;
+        QTest::newRow("mode 4 new frequency") << QByteArray::fromHex("0502")
+                                              << QByteArray::fromHex("0c00"
+                                                                     "0d01000000000005" "01f001f801f4"
+                                                                     "0500"
+                                                                     "0d0100001388000a" "01f401f401f4"
+                                                                     "0d01000027100006" "01f401f401f4"
+                                                                     "0d01000028a00005" "01f401f401f4")
+                                              << 4 << 0 << 0 << 0 << 1;
+        QTest::newRow("unknown command") << QByteArray()
+                                         << QByteArray::fromHex("0100ee") + mode1(0)
+                                         << 1 << 1 << 0 << 0 << 0;
+        QTest::newRow("invalid ack") << QByteArray()
+                                     << QByteArray::fromHex("0105")
+                                     << 0 << 1 << 0 << 0 << 0;
+        QTest::newRow("invalid sensor") << QByteArray()
+                                        << QByteArray::fromHex("0100") + mode1(0, 0) + mode1(0, 3)
+                                        << 2 << 1 << 0 << 0 << 0;
+        QTest::newRow("invalid record") << QByteArray()
+                                        << QByteArray::fromHex("0c00" "0d01000000000000" "000000000000")
+                                        << 1 << 1 << 0 << 0 << 0;
+        QTest::newRow("out of order") << QByteArray()
+                                      << QByteArray::fromHex("0100") + mode1(1000) + mode1(0)
+                                      << 2 << 0 << 1 << 0 << 0;
+        QTest::newRow("restart") << QByteArray()
+                                 << QByteArray::fromHex("0100") + mode1(1000) + QByteArray::fromHex("0200")
+                                    + QByteArray::fromHex("0a0001") + sample(0, 1, 1)
+                                 << 2 << 0 << 0 << 0 << 0;
+        QTest::newRow("missing sample") << QByteArray()
+                                        << QByteArray::fromHex("0100") + mode1(0) + mode1(2000)
+                                        << 2 << 0 << 0 << 1 << 0;
+        QTest::newRow("new frequency") << QByteArray::fromHex("0502")
+                                       << QByteArray::fromHex("0100") + mode1(0) + QByteArray::fromHex("0500")
+                                          + mode1(1000) + mode1(1500) + mode1(2000)
+                                       << 4 << 0 << 0 << 0 << 0;
+        QTest::newRow("same frequency") << QByteArray::fromHex("0501")
+                                        << QByteArray::fromHex("0100") + mode1(0) + QByteArray::fromHex("0500")
+                                           + mode1(1000) + mode1(3000)
+                                        << 3 << 0 << 0 << 1 << 0;
+    }
+
+    void streams()
+    {
+        QFETCH(QByteArray, sent);
+        QFETCH(QByteArray, stream);
+        QFETCH(int, samples);
+        QFETCH(int, framingErrors);
+        QFETCH(int, orderErrors);
+        QFETCH(int, gapErrors);
+        QFETCH(int, rateErrors);
+
+        stream.prepend(FREQUENCIES);
+        for(int chunk = 1; chunk <= stream.size(); ++chunk){
+            Decoder decoder;
+            decoder.commandsSent(reinterpret_cast<const quint8*>(sent.constData()), sent.size());
+            decode(decoder, stream, 0, chunk);
+
+            const Decoder::Stats &stats = decoder.stats();
+            QCOMPARE(stats.bytes, quint64(stream.size()));
+            QCOMPARE(stats.samples, quint64(samples));
+            QCOMPARE(stats.framingErrors, quint64(framingErrors));
+            QCOMPARE(stats.orderErrors, quint64(orderErrors));
+            QCOMPARE(stats.gapErrors, quint64(gapErrors));
+            QCOMPARE(stats.rateErrors, quint64(rateErrors));
+        }
+    }
+
+    void misalignedBulk()
+    {
+        Decoder decoder;
+        decode(decoder, FREQUENCIES + QByteArray::fromHex("02000a0002") + sample(0, 1, 1).mid(1)
+               + sample(1000, 1, 2) + QByteArray::fromHex("0a0001") + sample(2000, 1, 3));
+        const Decoder::Stats &stats = decoder.stats();
+        QVERIFY(stats.framingErrors + stats.orderErrors + stats.gapErrors > 0);
+    }
+
+    void frequencies()
+    {
+        Decoder decoder;
+        decode(decoder, QByteArray::fromHex("0b0102000a"));
+        QCOMPARE(decoder.interval(1), quint32(1000));
+        QCOMPARE(decoder.interval(2), quint32(500));
+        QCOMPARE(decoder.interval(3), quint32(0));
+        QCOMPARE(decoder.stats().frames, quint64(1));
+    }
+
+    void streamedRate()
+    {
+        Decoder onTime;
+        decode(onTime, FREQUENCIES + QByteArray::fromHex("0100"));
+        for(quint32 t = 0; t < 5; ++t){
+            decode(onTime, mode1(t * 1000), t * 1000);
+        }
+        onTime.tick(500);
+        onTime.tick(5000);
+        QCOMPARE(onTime.stats().rateErrors, quint64(0));
+
+        Decoder late;
+        decode(late, FREQUENCIES + QByteArray::fromHex("0100"));
+        decode(late, mode1(0) + mode1(1000), 3000);
+        late.tick(5000);
+        QCOMPARE(late.stats().rateErrors, quint64(1));
+        QCOMPARE(late.stats().gapErrors, quint64(0));
+    }
+
+    void bulkRate()
+    {
+        QByteArray bulk = QByteArray::fromHex("0a0005");
+        for(quint32 t = 0; t < 5; ++t){
+            bulk += sample(t * 1000, 1, 500);
+        }
+
+        Decoder onTime;
+        decode(onTime, FREQUENCIES + QByteArray::fromHex("0200"));
+        onTime.tick(5000);
+        decode(onTime, bulk, 5000);
+        QCOMPARE(onTime.stats().rateErrors, quint64(0));
+
+        Decoder late;
+        decode(late, FREQUENCIES + QByteArray::fromHex("0200"));
+        decode(late, QByteArray::fromHex("0a0001") + sample(0, 1, 500), 5000);
+        QCOMPARE(late.stats().rateErrors, quint64(1));
+    }
+
+    void noRateWithoutSamples()
+    {
+        Decoder stopped;
+        decode(stopped, FREQUENCIES + QByteArray::fromHex("0000"));
+        decode(stopped, QByteArray::fromHex("040000"), 5000);
+        stopped.tick(5000);
+        QCOMPARE(stopped.stats().rateErrors, quint64(0));
+
+        Decoder aggregated;
+        decode(aggregated, FREQUENCIES + QByteArray::fromHex("0c00"));
+        decode(aggregated, QByteArray::fromHex("0d01000000000005" "01f001f801f4"), 5000);
+        aggregated.tick(5000);
+        QCOMPARE(aggregated.stats().rateErrors, quint64(0));
+        QCOMPARE(aggregated.stats().framingErrors, quint64(0));
+    }
+};
+
+QTEST_APPLESS_MAIN(DecoderTest)
+
+#include "tst_decoder.moc"
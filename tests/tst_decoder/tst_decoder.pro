@@ -0,0 +1,17 @@
+QT -= gui
+QT += testlib
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+INCLUDEPATH += ../../src ../../validator/src
+
+SOURCES += \
+    tst_decoder.cpp \
+    ../../validator/src/Decoder.cpp
+
+HEADERS += \
+    ../../validator/src/Decoder.hpp \
+    ../../src/Protocol.hpp \
+    ../../src/Frequency.hpp
@@ -0,0 +1,170 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 azarias.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * File:   tst_scenario.cpp
+ * Author: azarias
+ *
+ * Created on 19/10/2026
+ */
+#include <QtTest>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QTemporaryFile>
+#include "Scenario.hpp"
+
+/**
+ * @brief The ScenarioTest class
+ * checks the values generated by the scenarios
+ * and the loading of scenario files
+ */
+class ScenarioTest : public QObject
+{
+    Q_OBJECT
+private:
+    static Scenario scenario(int base, const QJsonArray &components)
+    {
+        return Scenario(QJsonObject{{"base", base}, {"components", components}});
+    }
+
+    static QJsonObject periodic(const QString &shape, double amplitude, double period)
+    {
+        return QJsonObject{{"type", "periodic"}, {"shape", shape}, {"amplitude", amplitude}, {"period", period}};
+    }
+
+    static void compareNear(qint16 actual, int expected)
+    {
+        QVERIFY2(qAbs(actual - expected) <= 1, qPrintable(QString("%1 != %2").arg(actual).arg(expected)));
+    }
+
+private slots:
+    void emptyScenario()
+    {
+        QVERIFY(Scenario().isEmpty());
+        QVERIFY(!scenario(300, {}).isEmpty());
+        QCOMPARE(scenario(300, {}).valueAt(12345), qint16(300));
+    }
+
+    void sine()
+    {
+        Scenario s = scenario(512, {periodic("sine", 100, 1000)});
+        compareNear(s.valueAt(0), 512);
+        compareNear(s.valueAt(250), 612);
+        compareNear(s.valueAt(500), 512);
+        compareNear(s.valueAt(750), 412);
+        compareNear(s.valueAt(125), 512 + 71);
+        compareNear(s.valueAt(1250), 612);
+    }
+
+    void square()
+    {
+        Scenario s = scenario(512, {periodic("square", 100, 1000)});
+        compareNear(s.valueAt(100), 612);
+        compareNear(s.valueAt(600), 412);
+    }
+
+    void unknownShape()
+    {
+        Scenario s = scenario(512, {periodic("sqaure", 100, 1000), periodic("square", 10, 1000)});
+        QVERIFY(!s.isEmpty());
+        QCOMPARE(s.valueAt(100), qint16(522));
+        QCOMPARE(s.valueAt(600), qint16(502));
+    }
+
+    void nonIntegralPeriod()
+    {
+        Scenario s = scenario(512, {periodic("sine", 100, 999.6)});
+        compareNear(s.valueAt(250), 612);
+    }
+
+    void trendAndStep()
+    {
+        Scenario s = scenario(100, {
+                                  QJsonObject{{"type", "trend"}, {"slope", 2.0}},
+                                  QJsonObject{{"type", "step"}, {"amplitude", 50}, {"at", 10000}}
+                              });
+        compareNear(s.valueAt(0), 100);
+        compareNear(s.valueAt(5000), 110);
+        compareNear(s.valueAt(10000), 170);
+    }
+
+    void clamped()
+    {
+        QCOMPARE(scenario(1000, {periodic("sine", 500, 1000)}).valueAt(250), qint16(1023));
+        QCOMPARE(scenario(0, {periodic("sine", 500, 1000)}).valueAt(750), qint16(0));
+    }
+
+    void noiseBounded()
+    {
+        Scenario s = scenario(512, {QJsonObject{{"type", "noise"}, {"amplitude", 10}, {"period", 50}}});
+        for(quint32 t = 0; t < 500000; t += 37){
+            qint16 value = s.valueAt(t);
+            QVERIFY(value >= 502 && value <= 522);
+        }
+    }
+
+    void loadFile()
+    {
+        QJsonObject definition{{"base", 200}};
+        QJsonObject root{
+            {"1", definition},
+            {"3", definition},
+            {"0", definition},
+            {"4", definition},
+            {"257", definition},
+            {"-255", definition},
+            {"two", definition}
+        };
+        QTemporaryFile file;
+        QVERIFY(file.open());
+        file.write(QJsonDocument(root).toJson());
+        file.close();
+
+        bool ok = false;
+        QMap<qint8, Scenario> scenarios = Scenario::loadFile(file.fileName(), ok);
+        QVERIFY(ok);
+        QCOMPARE(scenarios.keys(), (QList<qint8>{1, 3}));
+        QCOMPARE(scenarios[1].valueAt(0), qint16(200));
+    }
+
+    void loadInvalidFile()
+    {
+        QTemporaryFile file;
+        QVERIFY(file.open());
+        file.write("not json");
+        file.close();
+
+        bool ok = true;
+        QVERIFY(Scenario::loadFile(file.fileName(), ok).isEmpty());
+        QVERIFY(!ok);
+
+        ok = true;
+        Scenario::loadFile("does/not/exist.json", ok);
+        QVERIFY(!ok);
+    }
+};
+
+QTEST_GUILESS_MAIN(ScenarioTest)
+
+#include "tst_scenario.moc"
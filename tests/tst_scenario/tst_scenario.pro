@@ -0,0 +1,16 @@
+QT -= gui
+QT += testlib
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+INCLUDEPATH += ../../src
+
+SOURCES += \
+    tst_scenario.cpp \
+    ../../src/Scenario.cpp
+
+HEADERS += \
+    ../../src/Scenario.hpp \
+    ../../src/Protocol.hpp
@@ -0,0 +1,25 @@
+#-------------------------------------------------
+#
+# Validator of the frames sent by the simulator
+#
+#-------------------------------------------------
+
+QT -= gui
+QT += serialport
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+INCLUDEPATH += ../src
+
+SOURCES += \
+        src/main.cpp \
+    src/Validator.cpp \
+    src/Decoder.cpp
+
+HEADERS += \
+    src/Validator.hpp \
+    src/Decoder.hpp \
+    ../src/Protocol.hpp \
+    ../src/Frequency.hpp
@@ -0,0 +1,316 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 azarias.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * File:   Decoder.cpp
+ * Author: azarias
+ *
+ * Created on 19/10/2026
+ */
+#include "Decoder.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include "Frequency.hpp"
+
+/**
+ * @brief RATE_TOLERANCE relative difference allowed between
+ * the samples received and the samples expected during a window
+ */
+constexpr double RATE_TOLERANCE = 0.1;
+
+/**
+ * @brief RATE_MARGIN samples allowed to be missing or in excess,
+ * whatever the duration of the window
+ */
+constexpr double RATE_MARGIN = 2.0;
+
+/**
+ * @brief intervalOf interval used by the simulator for the given frequency
+ * @param frequency frequency sent to or by the simulator
+ * @return the interval in milliseconds, 0 if the frequency is invalid
+ */
+static quint32 intervalOf(quint8 frequency)
+{
+    qint8 signedFrequency = qint8(frequency);
+    return signedFrequency > 0 ? toMilliseconds<quint32>(signedFrequency) : 0;
+}
+
+void Decoder::decode(const quint8 *data, qint64 size, qint64 now)
+{
+    m_now = now;
+    m_stats.bytes += quint64(size);
+    qint64 i = 0;
+    while(i < size){
+        if(m_staged > 0){
+            int missing = int(std::min<qint64>(m_frameSize - m_staged, size - i));
+            std::memcpy(m_stage.data() + m_staged, data + i, std::size_t(missing));
+            m_staged += missing;
+            i += missing;
+            if(m_staged < m_frameSize) return;
+            m_staged = 0;
+            handleFrame(m_stage.data());
+            continue;
+        }
+
+        m_frameSize = m_bulkRemaining > 0 ? SAMPLE_SIZE : frameSize(data[i]);
+        if(m_frameSize == 0){
+            ++m_stats.framingErrors;
+            ++i;
+            continue;
+        }
+
+        if(size - i >= m_frameSize){
+            handleFrame(data + i);
+            i += m_frameSize;
+        } else {
+            m_staged = int(size - i);
+            std::memcpy(m_stage.data(), data + i, std::size_t(m_staged));
+            i = size;
+        }
+    }
+}
+
+void Decoder::commandsSent(const quint8 *data, qint64 size)
+{
+    for(qint64 i = 0; i + 1 < size; i += 2){
+        if(data[i] >= CONFIGURE_FE_1 && data[i] <= CONFIGURE_FE_3){
+            m_sensors[std::size_t(data[i] - CONFIGURE_FE_1)].pendingInterval = intervalOf(data[i + 1]);
+        }
+    }
+}
+
+void Decoder::tick(qint64 now)
+{
+    m_now = now;
+    if(m_mode == WORKING_MODE::MODE_1){
+        checkRate();
+    }
+}
+
+const Decoder::Stats &Decoder::stats() const
+{
+    return m_stats;
+}
+
+quint32 Decoder::interval(int sensorId) const
+{
+    return m_sensors[std::size_t(sensorId - 1)].interval;
+}
+
+int Decoder::frameSize(quint8 command)
+{
+    switch (command) {
+    case STOP_MODE:
+    case START_MODE_1:
+    case START_MODE_2:
+    case START_MODE_3:
+    case START_MODE_4:
+    case CONFIGURE_FE_1:
+    case CONFIGURE_FE_2:
+    case CONFIGURE_FE_3:
+    case CONFIGURE_MODE_2:
+        return 2;
+    case GET_DATA:
+    case SEND_MODE2_DATA:
+        return 3;
+    case GET_FREQUENCIES:
+        return 5;
+    case SEND_MODE1_DATA:
+        return 1 + SAMPLE_SIZE;
+    case SEND_MODE4_DATA:
+        return MAX_FRAME_SIZE;
+    default:
+        return 0;
+    }
+}
+
+void Decoder::handleFrame(const quint8 *frame)
+{
+    if(m_bulkRemaining > 0){
+        handleSample(frame);
+        if(--m_bulkRemaining == 0){
+            checkRate();
+        }
+        return;
+    }
+
+    ++m_stats.frames;
+    switch (frame[0]) {
+    case GET_DATA:
+    case SEND_MODE2_DATA:
+        m_bulkRemaining = quint16((frame[1] << 8) | frame[2]);
+        if(m_bulkRemaining == 0){
+            checkRate();
+        }
+        return;
+    case GET_FREQUENCIES:
+        for(std::size_t i = 0; i < m_sensors.size(); ++i){
+            m_sensors[i].interval = intervalOf(frame[i + 1]);
+        }
+        restartWindow();
+        return;
+    case SEND_MODE1_DATA:
+        handleSample(frame + 1);
+        return;
+    case SEND_MODE4_DATA:
+        handleAggregate(frame);
+        return;
+    default:
+        handleAck(frame[0], frame[1]);
+        return;
+    }
+}
+
+void Decoder::handleAck(quint8 command, quint8 status)
+{
+    if(status > ERROR_BIT){
+        ++m_stats.framingErrors;
+        return;
+    }
+    if(status == ERROR_BIT) return;
+
+    switch (command) {
+    case STOP_MODE:
+    case START_MODE_1:
+    case START_MODE_2:
+    case START_MODE_3:
+    case START_MODE_4: {
+        WORKING_MODE mode = command == START_MODE_4 ? WORKING_MODE::MODE_4 : WORKING_MODE(command);
+        if(mode != m_mode){
+            m_mode = mode;
+            for(SensorTrack &sensor : m_sensors){
+                sensor.seen = false;
+            }
+        }
+        restartWindow();
+        return;
+    }
+    case CONFIGURE_FE_1:
+    case CONFIGURE_FE_2:
+    case CONFIGURE_FE_3: {
+        SensorTrack &sensor = m_sensors[std::size_t(command - CONFIGURE_FE_1)];
+        sensor.interval = sensor.pendingInterval;
+        sensor.relearn = true;
+        restartWindow();
+        return;
+    }
+    default:
+        return;
+    }
+}
+
+void Decoder::handleSample(const quint8 *sample)
+{
+    ++m_stats.samples;
+    quint64 raw = 0;
+    for(int i = 0; i < SAMPLE_SIZE; ++i){
+        raw = (raw << 8) | sample[i];
+    }
+    quint32 timestamp = quint32(raw >> 16);
+    quint8 sensorId = quint8((raw >> 10) & 0x3F);
+    if(!track(sensorId, timestamp, true)){
+        ++m_stats.framingErrors;
+    }
+}
+
+void Decoder::handleAggregate(const quint8 *record)
+{
+    ++m_stats.samples;
+    auto field = [record](int offset){ return quint16((record[offset] << 8) | record[offset + 1]); };
+    quint8 sensorId = record[1];
+    quint32 timestamp = (quint32(record[2]) << 24) | (quint32(record[3]) << 16)
+            | (quint32(record[4]) << 8) | quint32(record[5]);
+    quint16 count = field(6);
+    quint16 min = field(8);
+    quint16 max = field(10);
+    quint16 mean = field(12);
+    if(sensorId < 1 || sensorId > m_sensors.size() || count == 0 || min > mean || mean > max){
+        ++m_stats.framingErrors;
+        return;
+    }
+
+    SensorTrack &sensor = m_sensors[sensorId - 1];
+    if(sensor.seen && timestamp > sensor.lastTimestamp && sensor.interval > 0){
+        if(timestamp - sensor.lastTimestamp == quint64(sensor.lastCount) * sensor.interval){
+            sensor.relearn = false;
+        } else if(!sensor.relearn){
+            ++m_stats.rateErrors;
+        }
+    }
+    track(sensorId, timestamp, false);
+    sensor.lastCount = count;
+}
+
+bool Decoder::track(quint8 sensorId, quint32 timestamp, bool checkInterval)
+{
+    if(sensorId < 1 || sensorId > m_sensors.size()) return false;
+
+    SensorTrack &sensor = m_sensors[sensorId - 1];
+    if(checkInterval){
+        ++sensor.windowSamples;
+    }
+    if(!sensor.seen){
+        sensor.seen = true;
+        sensor.lastTimestamp = timestamp;
+        return true;
+    }
+
+    if(timestamp <= sensor.lastTimestamp){
+        ++m_stats.orderErrors;
+    } else if(checkInterval && sensor.interval > 0){
+        if(timestamp - sensor.lastTimestamp == sensor.interval){
+            sensor.relearn = false;
+        } else if(!sensor.relearn){
+            ++m_stats.gapErrors;
+        }
+    }
+    sensor.lastTimestamp = timestamp;
+    return true;
+}
+
+void Decoder::checkRate()
+{
+    if(m_mode == WORKING_MODE::NO_MODE || m_mode == WORKING_MODE::MODE_4) return;
+    qint64 elapsed = m_now - m_windowStart;
+    if(elapsed < RATE_WINDOW) return;
+
+    for(const SensorTrack &sensor : m_sensors){
+        if(sensor.interval == 0) continue;
+        double expected = double(elapsed) / sensor.interval;
+        double received = double(sensor.windowSamples);
+        if(std::abs(received - expected) > expected * RATE_TOLERANCE + RATE_MARGIN){
+            ++m_stats.rateErrors;
+        }
+    }
+    restartWindow();
+}
+
+void Decoder::restartWindow()
+{
+    m_windowStart = m_now;
+    for(SensorTrack &sensor : m_sensors){
+        sensor.windowSamples = 0;
+    }
+}
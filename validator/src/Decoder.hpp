@@ -0,0 +1,269 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 azarias.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * File:   Decoder.hpp
+ * Author: azarias
+ *
+ * Created on 19/10/2026
+ */
+#pragma once
+
+#include <QtGlobal>
+#include <array>
+#include "Protocol.hpp"
+
+/**
+ * @brief The Decoder class
+ * decodes the stream sent by the simulator and checks the framing,
+ * the order of the timestamps of each sensor, and the rate at which
+ * each sensor emits against its configured frequency
+ * does not touch any device, time is given by the caller (in milliseconds)
+ */
+class Decoder
+{
+public:
+    /**
+     * @brief The Stats struct
+     * counters of the stream
+     */
+    struct Stats
+    {
+        quint64 bytes = 0;
+        quint64 frames = 0;
+        quint64 samples = 0;
+
+        /**
+         * @brief framingErrors unknown commands, invalid acks, sensor ids or records
+         */
+        quint64 framingErrors = 0;
+
+        /**
+         * @brief orderErrors timestamps of a sensor going backward
+         */
+        quint64 orderErrors = 0;
+
+        /**
+         * @brief gapErrors two consecutive timestamps of a sensor
+         * not separated by its configured interval
+         */
+        quint64 gapErrors = 0;
+
+        /**
+         * @brief rateErrors number of samples received during a check window
+         * too far from the configured frequency of the sensor, or in mode 4,
+         * number of values of a record not matching the time until the next record
+         */
+        quint64 rateErrors = 0;
+    };
+
+    /**
+     * @brief RATE_WINDOW minimum duration of a rate check window, in milliseconds
+     */
+    static constexpr qint64 RATE_WINDOW = 1000;
+
+    /**
+     * @brief decode decodes a chunk of the stream
+     * complete frames are read in place, only a frame cut
+     * at the end of the chunk is copied, to be completed by the next chunk
+     * @param data bytes received
+     * @param size number of bytes
+     * @param now time at which the chunk was received
+     */
+    void decode(const quint8 *data, qint64 size, qint64 now);
+
+    /**
+     * @brief commandsSent tells the decoder which commands were sent to the simulator,
+     * to know the frequencies that will be configured
+     * @param data the commands, two bytes each
+     * @param size number of bytes
+     */
+    void commandsSent(const quint8 *data, qint64 size);
+
+    /**
+     * @brief tick checks the rate of the sensors when the values are sent
+     * one by one (mode 1), must be called regularly
+     * @param now current time
+     */
+    void tick(qint64 now);
+
+    /**
+     * @brief stats counters since the beginning of the stream
+     * @return
+     */
+    const Stats &stats() const;
+
+    /**
+     * @brief interval configured interval of a sensor
+     * @param sensorId id of the sensor (1 to 3)
+     * @return the interval in milliseconds, 0 if unknown
+     */
+    quint32 interval(int sensorId) const;
+
+private:
+    /**
+     * @brief The SensorTrack struct
+     * what is known about the stream of a sensor
+     */
+    struct SensorTrack
+    {
+        bool seen = false;
+
+        quint32 lastTimestamp = 0;
+
+        /**
+         * @brief interval configured time between two values, 0 if unknown
+         */
+        quint32 interval = 0;
+
+        /**
+         * @brief pendingInterval interval sent with a CONFIGURE_FE command,
+         * applied once acknowledged
+         */
+        quint32 pendingInterval = 0;
+
+        /**
+         * @brief relearn the frequency was configured, values generated before
+         * may still use the previous interval, until the first one using the configured one
+         */
+        bool relearn = false;
+
+        /**
+         * @brief lastCount number of values of the last mode 4 record,
+         * the next record must start lastCount intervals later
+         */
+        quint16 lastCount = 0;
+
+        /**
+         * @brief windowSamples samples received during the current rate check window
+         */
+        quint64 windowSamples = 0;
+    };
+
+    /**
+     * @brief MAX_FRAME_SIZE size of the biggest frame (mode 4 record)
+     */
+    static constexpr int MAX_FRAME_SIZE = 14;
+
+    /**
+     * @brief SAMPLE_SIZE size of a sample, without its command byte
+     */
+    static constexpr int SAMPLE_SIZE = 6;
+
+    /**
+     * @brief m_stage frame cut at the end of a chunk
+     */
+    std::array<quint8, MAX_FRAME_SIZE> m_stage;
+
+    /**
+     * @brief m_staged number of bytes of m_stage already received
+     */
+    int m_staged = 0;
+
+    /**
+     * @brief m_frameSize size of the frame being decoded
+     */
+    int m_frameSize = 0;
+
+    /**
+     * @brief m_bulkRemaining number of samples still expected
+     * after a GET_DATA or SEND_MODE2_DATA header
+     */
+    quint16 m_bulkRemaining = 0;
+
+    /**
+     * @brief m_mode mode of the simulator, known from the acks
+     */
+    WORKING_MODE m_mode = WORKING_MODE::NO_MODE;
+
+    /**
+     * @brief m_now time at which the chunk being decoded was received
+     */
+    qint64 m_now = 0;
+
+    /**
+     * @brief m_windowStart beginning of the current rate check window
+     */
+    qint64 m_windowStart = 0;
+
+    std::array<SensorTrack, SENSOR_COUNT> m_sensors;
+
+    Stats m_stats;
+
+    /**
+     * @brief frameSize size of the frame starting with the given command
+     * @param command first byte of the frame
+     * @return 0 if the command is unknown
+     */
+    static int frameSize(quint8 command);
+
+    /**
+     * @brief handleFrame checks a complete frame
+     * @param frame bytes of the frame, m_frameSize long
+     */
+    void handleFrame(const quint8 *frame);
+
+    /**
+     * @brief handleAck checks the acknowledgement of a command
+     * @param command the command acknowledged
+     * @param status SUCCESS_BIT or ERROR_BIT
+     */
+    void handleAck(quint8 command, quint8 status);
+
+    /**
+     * @brief handleSample checks a 6 bytes sample
+     * @param sample bytes of the sample
+     */
+    void handleSample(const quint8 *sample);
+
+    /**
+     * @brief handleAggregate checks a mode 4 record, and that the previous
+     * record of the sensor counted one value per interval until this one
+     * @param record bytes of the record, command byte included
+     */
+    void handleAggregate(const quint8 *record);
+
+    /**
+     * @brief track checks that the timestamps of the sensor keep increasing
+     * @param sensorId sensor that sent the value
+     * @param timestamp time at which the value was generated
+     * @param checkInterval whether the interval must also be checked
+     * @return false if the sensor id is invalid
+     */
+    bool track(quint8 sensorId, quint32 timestamp, bool checkInterval);
+
+    /**
+     * @brief checkRate compares the samples received during the window
+     * with the configured frequencies, then starts a new window
+     * does nothing if the window is shorter than RATE_WINDOW,
+     * or if the simulator does not send samples (stopped or mode 4,
+     * checked by handleAggregate)
+     */
+    void checkRate();
+
+    /**
+     * @brief restartWindow starts a new rate check window
+     */
+    void restartWindow();
+};
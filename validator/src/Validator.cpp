@@ -0,0 +1,87 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 azarias.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * File:   Validator.cpp
+ * Author: azarias
+ *
+ * Created on 19/10/2026
+ */
+#include "Validator.hpp"
+
+constexpr int READ_BUFFER_SIZE = 64 * 1024;
+
+Validator::Validator(QSerialPort &port, QObject *parent) : QObject(parent),
+    m_port(port),
+    m_readBuffer(READ_BUFFER_SIZE, 0)
+{
+    m_reportTimer.setSingleShot(false);
+    m_reportTimer.setInterval(1000);
+    m_pollTimer.setSingleShot(false);
+
+    connect(&port, &QSerialPort::readyRead, [&](){ this->readAvailable(); });
+    connect(&m_reportTimer, &QTimer::timeout, [&](){ this->report(); });
+    connect(&m_pollTimer, &QTimer::timeout, [&](){ this->send(QByteArray::fromHex("0400")); });
+
+    m_clock.start();
+    m_reportTimer.start();
+}
+
+bool Validator::send(const QByteArray &commands)
+{
+    m_decoder.commandsSent(reinterpret_cast<const quint8*>(commands.constData()), commands.size());
+    return m_port.write(commands) == commands.size() && m_port.flush();
+}
+
+void Validator::startPolling(int interval)
+{
+    m_pollTimer.setInterval(interval);
+    m_pollTimer.start();
+}
+
+void Validator::readAvailable()
+{
+    qint64 read;
+    while((read = m_port.read(m_readBuffer.data(), m_readBuffer.size())) > 0){
+        m_decoder.decode(reinterpret_cast<const quint8*>(m_readBuffer.constData()), read, m_clock.elapsed());
+    }
+}
+
+void Validator::report()
+{
+    m_decoder.tick(m_clock.elapsed());
+    const Decoder::Stats &stats = m_decoder.stats();
+    qInfo().nospace() << stats.bytes - m_lastReport.bytes << " B/s, "
+                      << stats.frames - m_lastReport.frames << " frames/s, "
+                      << stats.samples - m_lastReport.samples << " samples/s | total "
+                      << stats.samples << " samples, errors : framing "
+                      << stats.framingErrors << ", order "
+                      << stats.orderErrors << ", gap "
+                      << stats.gapErrors << ", rate "
+                      << stats.rateErrors << " | intervals (ms) "
+                      << m_decoder.interval(1) << " "
+                      << m_decoder.interval(2) << " "
+                      << m_decoder.interval(3);
+    m_lastReport = stats;
+}
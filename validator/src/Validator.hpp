@@ -0,0 +1,105 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 azarias.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * File:   Validator.hpp
+ * Author: azarias
+ *
+ * Created on 19/10/2026
+ */
+#pragma once
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QTimer>
+#include <QtSerialPort>
+#include "Decoder.hpp"
+
+/**
+ * @brief The Validator class
+ * acts like the desktop, feeds everything the simulator sends
+ * to the decoder and reports the throughput and the errors every second
+ */
+class Validator : public QObject
+{
+    Q_OBJECT
+public:
+    explicit Validator(QSerialPort &port, QObject *parent = nullptr);
+
+    /**
+     * @brief send sends commands to the simulator
+     * @param commands the commands, two bytes each
+     * @return if all the bytes were written
+     */
+    bool send(const QByteArray &commands);
+
+    /**
+     * @brief startPolling asks the data (GET_DATA) on a regular basis, for the mode 3
+     * @param interval time between two requests, in milliseconds
+     */
+    void startPolling(int interval);
+
+private:
+    /**
+     * @brief m_port the port the simulator writes to
+     */
+    QSerialPort &m_port;
+
+    /**
+     * @brief m_reportTimer timer to print the stats
+     */
+    QTimer m_reportTimer;
+
+    /**
+     * @brief m_pollTimer timer to send GET_DATA
+     */
+    QTimer m_pollTimer;
+
+    /**
+     * @brief m_clock time since the validator started
+     */
+    QElapsedTimer m_clock;
+
+    /**
+     * @brief m_readBuffer buffer the port is read into, allocated once
+     */
+    QByteArray m_readBuffer;
+
+    Decoder m_decoder;
+
+    /**
+     * @brief m_lastReport stats at the time of the last report
+     */
+    Decoder::Stats m_lastReport;
+
+    /**
+     * @brief readAvailable reads everything available on the port
+     */
+    void readAvailable();
+
+    /**
+     * @brief report prints the stats since the last report
+     */
+    void report();
+};
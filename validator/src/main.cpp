@@ -0,0 +1,98 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2017-2018 azarias.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * File:   main.cpp
+ * Author: azarias
+ *
+ * Created on 19/10/2026
+ */
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDebug>
+#include <QRegularExpression>
+#include <QtSerialPort>
+
+#include "Validator.hpp"
+
+/**
+Takes the place of the desktop on the serial connection, and checks everything the simulator sends.
+SETUP (same as the desktop) :
+command 1 (WeatherSimulator folder) : socat PTY,link=./arduino-sim,raw,echo=0 PTY,link=./virtual-tty,raw,echo=0
+command 2 (WeatherSimulator folder) : ./WeatherSimulator
+command 3 (WeatherSimulator folder) : ./WeatherValidator ./virtual-tty --send 0100
+(0100 starts the mode 1, 0200 the mode 2, ...)
+The mode 3 only sends data when asked, use --poll to ask it regularly :
+command 3 (WeatherSimulator folder) : ./WeatherValidator ./virtual-tty --send 0300 --poll 1000
+The frequencies of the sensors are asked (GET_FREQUENCIES) before anything else,
+to know the rate each sensor is expected to emit at
+*/
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    parser.addPositionalArgument("port", "Serial port the simulator writes to", "[port]");
+    QCommandLineOption sendOption("send", "Commands (hexadecimal) to send to the simulator once connected", "bytes");
+    parser.addOption(sendOption);
+    QCommandLineOption pollOption("poll", "Sends GET_DATA every <ms> milliseconds (mode 3)", "ms");
+    parser.addOption(pollOption);
+    parser.process(a);
+
+    QString commands = parser.value(sendOption).remove(' ');
+    if(!QRegularExpression("^([0-9a-fA-F]{4})*$").match(commands).hasMatch()){
+        qWarning() << "Invalid --send value" << commands << ": expected hexadecimal commands of two bytes each";
+        return -1;
+    }
+
+    int pollInterval = 0;
+    if(parser.isSet(pollOption)){
+        bool ok = false;
+        pollInterval = parser.value(pollOption).toInt(&ok);
+        if(!ok || pollInterval <= 0){
+            qWarning() << "Invalid --poll value" << parser.value(pollOption) << ": expected a positive number of milliseconds";
+            return -1;
+        }
+    }
+
+    QString portName = parser.positionalArguments().value(0, "./virtual-tty");
+    QSerialPort port(portName);
+    qWarning() << "Starting validator on" << portName << "...";
+
+    if(!port.open(QIODevice::ReadWrite)){
+        qWarning() << port.errorString() << "\n" << port.error();
+        return -1;
+    }
+
+    Validator v(port, nullptr);
+
+    v.send(QByteArray::fromHex("0b00") + QByteArray::fromHex(commands.toLatin1()));
+    if(pollInterval > 0){
+        v.startPolling(pollInterval);
+    }
+
+    return a.exec();
+}